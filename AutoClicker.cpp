@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 #include "Icon.h" // resource header with IDI_APPICON
+#include "TriggerCore.h" // portable hold-to-fire state machine (tested on Linux under tests/)
 
 #pragma comment(lib, "comctl32.lib")
 #pragma comment(lib, "winmm.lib")
@@ -68,6 +69,11 @@ enum : int {
     // Language
     IDC_BTN_LANG = 129,
 
+    // Hold-to-fire trigger
+    IDC_CHECK_TRIGGER = 130,
+    IDC_COMBO_TRIGGER = 131,
+    IDC_BTN_TRIGKEY = 132,   // "press a key" capture
+
     // Static labels (for localization)
     IDC_LBL_INTERVAL = 200,
     IDC_LBL_BUTTON = 201,
@@ -86,6 +92,8 @@ enum : int { IDM_TRAY_SHOWHIDE = 40001, IDM_TRAY_STARTSTOP, IDM_TRAY_EXIT };
 static const UINT WM_APP_AUTOSTOP = WM_APP + 1;  // worker finished by condition
 static const UINT WM_APP_PICKED = WM_APP + 2;  // mouse pick finished (x in wParam, y in lParam)
 static const UINT WM_APP_TRAY = WM_APP + 3;  // tray icon callback
+static const UINT WM_APP_TRIGLAT = WM_APP + 4;  // hook saw press → first injected event (µs in wParam), hook delivery lag (ms in lParam)
+static const UINT WM_APP_TRIGKEY = WM_APP + 5;  // trigger key captured (raw VK in wParam)
 
 // ---------------------- Globals -----------------------------
 static std::atomic<bool> g_running{ false };
@@ -105,6 +113,24 @@ static std::atomic<bool> g_pickSeq{ false };  // sequence pick
 static std::atomic<bool> g_waitUp{ false };   // swallow matching UP
 static HHOOK g_mouseHook = nullptr;
 
+// Hold-to-fire trigger state
+enum TriggerSrc { TRIG_KEY = 0, TRIG_MIDDLE = 1, TRIG_X1 = 2, TRIG_X2 = 3 }; // combo order
+static int g_trigSrc = TRIG_X1;   // read-only while armed
+static UINT g_trigKeyVK = 0;      // trigger key as captured/saved (UI thread)
+static UINT g_trigVK = 0;         // copy of g_trigKeyVK while armed, valid if g_trigSrc == TRIG_KEY
+static std::atomic<bool> g_keyCapture{ false }; // waiting for the trigger key
+static HHOOK g_kbdHook = nullptr;
+static std::atomic<DWORD> g_trigHookLag{ 0 }; // ms between the input's own timestamp and our hook seeing it (GetTickCount resolution)
+static bool g_trigArmed = false;  // UI thread only
+static TriggerCore g_trig;        // edges from the hooks → clicks on g_worker
+static std::thread g_trigHookThread;   // owns the LL hooks + their message loop
+static DWORD g_trigHookTid = 0;
+static std::atomic<bool> g_trigHooked{ false };
+static std::atomic<bool> g_trigSwallowed{ false }; // trigger DOWN was swallowed, its UP is still due
+static bool g_trigKeyHeldAtArm = false;             // trigger key already down when armed: pass it through until its UP (hook thread)
+static std::atomic<int> g_trigWaitUp{ 0 };         // disarmed while held: LowLevelMouseProc swallows this trigger's UP (TRIG_MIDDLE..TRIG_X2)
+static long long g_latLast = 0, g_latMin = 0, g_latMax = 0, g_latSum = 0; static unsigned g_latCount = 0; // µs, UI thread only
+
 // Tray state
 static bool g_hasTray = false;
 static NOTIFYICONDATAW g_nid{};
@@ -131,7 +157,9 @@ enum SId : int {
     S_RUNNING, S_HOLDING, S_SEQ_RUNNING,
     S_STOPPED, S_STOPPED_COND,
     S_TRAY_TIP, S_MENU_SHOW, S_MENU_HIDE, S_MENU_START, S_MENU_STOP, S_MENU_EXIT,
-    S_LANG_BTN
+    S_LANG_BTN,
+    S_TRIGGER, S_TRIG_KEY, S_ARMED, S_TRIG_NOKEY, S_TRIG_HOOK_FAIL, S_TRIG_LATENCY,
+    S_TRIG_KEY_SET, S_TRIG_KEY_PROMPT, S_TRIG_KEY_IS_HOTKEY, S_TRIG_KEY_OK
 };
 
 static const wchar_t* RU[] = {
@@ -150,7 +178,10 @@ static const wchar_t* RU[] = {
     L"Работает… Нажмите хоткей для остановки.", L"Удержание… Нажмите хоткей для отпускания.", L"Сценарий запущен… Нажмите хоткей для остановки.",
     L"Остановлено.", L"Остановлено (условие выполнено).",
     L"LightClick — автокликер", L"Показать", L"Скрыть", L"Старт", L"Стоп", L"Выход",
-    L"Язык: Русский"
+    L"Язык: Русский",
+    L"Клик при удержании:", L"Клавиша клавиатуры", L"Готов… Держите триггер для кликов. Хоткей — снять.", L"Сначала задайте клавишу-триггер.", L"Не удалось установить хук ввода.",
+    L"Хук→клик %.3f мс [%.3f/%.3f/%.3f] n=%u, лаг %u мс",
+    L"Задать клавишу…", L"Нажмите клавишу-триггер (в режиме она глушится)…", L"Клавиша-триггер не может совпадать с хоткеем старт/стоп.", L"Клавиша-триггер задана."
 };
 static const wchar_t* EN[] = {
     L"Interval:", L"[ms]", L"CPS mode", L"Mouse button:",
@@ -168,7 +199,10 @@ static const wchar_t* EN[] = {
     L"Running… Press hotkey to stop.", L"Holding… Press hotkey to release.", L"Sequence started… Press hotkey to stop.",
     L"Stopped.", L"Stopped (condition met).",
     L"LightClick — autoclicker", L"Show", L"Hide", L"Start", L"Stop", L"Exit",
-    L"Language: English"
+    L"Language: English",
+    L"Click while held:", L"Keyboard key", L"Armed… Hold the trigger to click. Press hotkey to disarm.", L"Set a trigger key first.", L"Could not install the input hook.",
+    L"Hook→click %.3f ms [%.3f/%.3f/%.3f] n=%u, lag %u ms",
+    L"Set key…", L"Press the trigger key (swallowed while armed)…", L"Trigger key can't be the Start/Stop hotkey.", L"Trigger key set."
 };
 static inline LPCWSTR LS(SId id) { return (g_lang == LANG_EN) ? EN[id] : RU[id]; }
 
@@ -219,6 +253,8 @@ static std::wstring VkToString(UINT vk) {
     case VK_PRIOR: return L"PgUp"; case VK_NEXT: return L"PgDn"; case VK_SPACE: return L"Space"; case VK_TAB: return L"Tab";
     case VK_ESCAPE: return L"Esc"; case VK_RETURN: return L"Enter"; case VK_BACK: return L"Backspace";
     case VK_LEFT: return L"Left"; case VK_RIGHT: return L"Right"; case VK_UP: return L"Up"; case VK_DOWN: return L"Down";
+    case VK_LSHIFT: return L"LShift"; case VK_RSHIFT: return L"RShift"; case VK_LCONTROL: return L"LCtrl"; case VK_RCONTROL: return L"RCtrl";
+    case VK_LMENU: return L"LAlt"; case VK_RMENU: return L"RAlt"; case VK_CAPITAL: return L"CapsLock"; case VK_LWIN: return L"LWin"; case VK_RWIN: return L"RWin";
     default: { wchar_t b[16]; _snwprintf_s(b, _TRUNCATE, L"VK_%02X", vk); return b; }
     }
 }
@@ -261,7 +297,9 @@ static void SaveSettings(HWND hWnd) {
     int stop_mode = Button_GetCheck(GetDlgItem(hWnd, IDC_RADIO_CLICKS)) == BST_CHECKED ? 1 : Button_GetCheck(GetDlgItem(hWnd, IDC_RADIO_SECONDS)) == BST_CHECKED ? 2 : 0;
     int max_clicks = ReadInt(GetDlgItem(hWnd, IDC_EDIT_CLICKS), 100); int max_seconds = ReadInt(GetDlgItem(hWnd, IDC_EDIT_SECONDS), 10);
     BOOL autostart = (Button_GetCheck(GetDlgItem(hWnd, IDC_CHECK_AUTOSTART)) == BST_CHECKED); BOOL sequence = (Button_GetCheck(GetDlgItem(hWnd, IDC_CHECK_SEQUENCE)) == BST_CHECKED);
+    BOOL trigger = (Button_GetCheck(GetDlgItem(hWnd, IDC_CHECK_TRIGGER)) == BST_CHECKED); int trigSrc = (int)SendMessageW(GetDlgItem(hWnd, IDC_COMBO_TRIGGER), CB_GETCURSEL, 0, 0);
     W(L"Main", L"interval", interval); W(L"Main", L"cps", isCps); W(L"Main", L"button", btn); W(L"Main", L"double", dbl); W(L"Main", L"fixed", fixed); W(L"Main", L"x", x); W(L"Main", L"y", y); W(L"Main", L"hold", hold); W(L"Main", L"jitter", jitter); W(L"Main", L"stop_mode", stop_mode); W(L"Main", L"max_clicks", max_clicks); W(L"Main", L"max_seconds", max_seconds); W(L"Main", L"autostart", autostart); W(L"Main", L"sequence", sequence); W(L"Main", L"lang", g_lang);
+    W(L"Trigger", L"enabled", trigger); W(L"Trigger", L"source", trigSrc >= 0 ? trigSrc : TRIG_X1); W(L"Trigger", L"vk", (int)g_trigKeyVK);
     // Hotkey
     WORD hk = (WORD)SendMessageW(GetDlgItem(hWnd, IDC_HOTKEY), HKM_GETHOTKEY, 0, 0); BYTE vk = LOBYTE(hk); BYTE m = HIBYTE(hk);
     W(L"Hotkey", L"vk", vk ? vk : (BYTE)g_hotkeyVK); int modsBits = 0; if (m & HOTKEYF_CONTROL) modsBits |= MOD_CONTROL; if (m & HOTKEYF_SHIFT) modsBits |= MOD_SHIFT; if (m & HOTKEYF_ALT) modsBits |= MOD_ALT; W(L"Hotkey", L"mods", modsBits);
@@ -276,12 +314,14 @@ static void LoadSettings(HWND hWnd) {
     int interval = R(L"Main", L"interval", 100); int isCps = R(L"Main", L"cps", 0); int btn = R(L"Main", L"button", 0); int dbl = R(L"Main", L"double", 0); int fixed = R(L"Main", L"fixed", 0);
     int x = R(L"Main", L"x", 0); int y = R(L"Main", L"y", 0); int hold = R(L"Main", L"hold", 0); int jitter = R(L"Main", L"jitter", 0); int stop_mode = R(L"Main", L"stop_mode", 0);
     int max_clicks = R(L"Main", L"max_clicks", 100); int max_seconds = R(L"Main", L"max_seconds", 10); int autostart = R(L"Main", L"autostart", 0); int sequence = R(L"Main", L"sequence", 0);
+    int trigger = R(L"Trigger", L"enabled", 0); int trigSrc = R(L"Trigger", L"source", TRIG_X1); int trigVk = R(L"Trigger", L"vk", 0);
     SetInt(GetDlgItem(hWnd, IDC_EDIT_INTERVAL), interval); Button_SetCheck(GetDlgItem(hWnd, IDC_CHECK_CPS), isCps ? BST_CHECKED : BST_UNCHECKED);
     SendMessageW(GetDlgItem(hWnd, IDC_COMBO_BUTTON), CB_SETCURSEL, btn, 0); Button_SetCheck(GetDlgItem(hWnd, IDC_CHECK_DOUBLE), dbl ? BST_CHECKED : BST_UNCHECKED);
     Button_SetCheck(GetDlgItem(hWnd, IDC_CHECK_FIXED), fixed ? BST_CHECKED : BST_UNCHECKED); SetInt(GetDlgItem(hWnd, IDC_EDIT_X), x); SetInt(GetDlgItem(hWnd, IDC_EDIT_Y), y);
     Button_SetCheck(GetDlgItem(hWnd, IDC_CHECK_HOLD), hold ? BST_CHECKED : BST_UNCHECKED); SetInt(GetDlgItem(hWnd, IDC_EDIT_JITTER), jitter);
     Button_SetCheck(GetDlgItem(hWnd, IDC_RADIO_INF), stop_mode == 0 ? BST_CHECKED : BST_UNCHECKED); Button_SetCheck(GetDlgItem(hWnd, IDC_RADIO_CLICKS), stop_mode == 1 ? BST_CHECKED : BST_UNCHECKED); Button_SetCheck(GetDlgItem(hWnd, IDC_RADIO_SECONDS), stop_mode == 2 ? BST_CHECKED : BST_UNCHECKED);
     SetInt(GetDlgItem(hWnd, IDC_EDIT_CLICKS), max_clicks); SetInt(GetDlgItem(hWnd, IDC_EDIT_SECONDS), max_seconds); Button_SetCheck(GetDlgItem(hWnd, IDC_CHECK_AUTOSTART), autostart ? BST_CHECKED : BST_UNCHECKED); Button_SetCheck(GetDlgItem(hWnd, IDC_CHECK_SEQUENCE), sequence ? BST_CHECKED : BST_UNCHECKED);
+    Button_SetCheck(GetDlgItem(hWnd, IDC_CHECK_TRIGGER), trigger ? BST_CHECKED : BST_UNCHECKED); SendMessageW(GetDlgItem(hWnd, IDC_COMBO_TRIGGER), CB_SETCURSEL, (trigSrc >= TRIG_KEY && trigSrc <= TRIG_X2) ? trigSrc : TRIG_X1, 0); g_trigKeyVK = (UINT)trigVk & 0xFF;
     // Sequence
     g_steps.clear(); int cnt = R(L"Seq", L"count", 0); for (int i = 0; i < cnt; ++i) { wchar_t kx[32], ky[32], kd[32]; _snwprintf_s(kx, _TRUNCATE, L"x%d", i); _snwprintf_s(ky, _TRUNCATE, L"y%d", i); _snwprintf_s(kd, _TRUNCATE, L"d%d", i); Step s; s.x = R(L"Seq", kx, 0); s.y = R(L"Seq", ky, 0); s.delay_ms = R(L"Seq", kd, 100); g_steps.push_back(s); } SetRunAtStartup(autostart != 0);
 }
@@ -298,6 +338,18 @@ static void UpdateButtonCombo(HWND hWnd) {
     SendMessageW(cb, CB_SETCURSEL, sel >= 0 ? sel : 0, 0);
 }
 
+static void UpdateTriggerCombo(HWND hWnd) {
+    HWND cb = GetDlgItem(hWnd, IDC_COMBO_TRIGGER); int sel = (int)SendMessageW(cb, CB_GETCURSEL, 0, 0);
+    SendMessageW(cb, CB_RESETCONTENT, 0, 0);
+    SendMessageW(cb, CB_ADDSTRING, 0, (LPARAM)LS(S_TRIG_KEY));
+    SendMessageW(cb, CB_ADDSTRING, 0, (LPARAM)LS(S_BTN_MIDDLE));
+    SendMessageW(cb, CB_ADDSTRING, 0, (LPARAM)LS(S_BTN_X1));
+    SendMessageW(cb, CB_ADDSTRING, 0, (LPARAM)LS(S_BTN_X2));
+    SendMessageW(cb, CB_SETCURSEL, sel >= 0 ? sel : TRIG_X1, 0);
+}
+
+static void SetTrigKeyLabel(HWND hWnd) { SetWindowTextW(GetDlgItem(hWnd, IDC_BTN_TRIGKEY), g_trigKeyVK ? VkToString(g_trigKeyVK).c_str() : LS(S_TRIG_KEY_SET)); }
+
 static void UpdateTexts(HWND hWnd) {
     // Labels/static
     SetWindowTextW(GetDlgItem(hWnd, IDC_LBL_INTERVAL), LS(S_INTERVAL));
@@ -319,6 +371,8 @@ static void UpdateTexts(HWND hWnd) {
     SetWindowTextW(GetDlgItem(hWnd, IDC_LBL_SEQ_DELAY), LS(S_SEQ_DELAY));
     SetWindowTextW(GetDlgItem(hWnd, IDC_BTN_ADD_STEP), LS(S_ADD_POINT));
     SetWindowTextW(GetDlgItem(hWnd, IDC_BTN_LANG), LS(S_LANG_BTN));
+    SetWindowTextW(GetDlgItem(hWnd, IDC_CHECK_TRIGGER), LS(S_TRIGGER));
+    SetTrigKeyLabel(hWnd);
 
     // Unit label depends on CPS + lang
     SetWindowTextW(GetDlgItem(hWnd, IDC_STATIC_UNIT), LS(S_UNIT_MS));
@@ -335,6 +389,7 @@ static void UpdateTexts(HWND hWnd) {
 
     // Button combo items
     UpdateButtonCombo(hWnd);
+    UpdateTriggerCombo(hWnd);
 
     // Start button text
     SetStartBtnLabel(hWnd);
@@ -350,6 +405,8 @@ static void UpdateUIState(HWND hWnd) {
     SetWindowTextW(GetDlgItem(hWnd, IDC_STATIC_UNIT), cps ? L"[CPS]" : LS(S_UNIT_MS));
     BOOL byClicks = (Button_GetCheck(GetDlgItem(hWnd, IDC_RADIO_CLICKS)) == BST_CHECKED);
     BOOL bySecs = (Button_GetCheck(GetDlgItem(hWnd, IDC_RADIO_SECONDS)) == BST_CHECKED);
+    BOOL trig = !seq && (Button_GetCheck(GetDlgItem(hWnd, IDC_CHECK_TRIGGER)) == BST_CHECKED); // stop conditions don't apply: release stops
+    BOOL trigKey = (int)SendMessageW(GetDlgItem(hWnd, IDC_COMBO_TRIGGER), CB_GETCURSEL, 0, 0) == TRIG_KEY;
     EnableWindow(GetDlgItem(hWnd, IDC_EDIT_INTERVAL), !seq && !hold);
     EnableWindow(GetDlgItem(hWnd, IDC_CHECK_CPS), !seq && !hold);
     EnableWindow(GetDlgItem(hWnd, IDC_CHECK_DOUBLE), TRUE);
@@ -359,11 +416,14 @@ static void UpdateUIState(HWND hWnd) {
     EnableWindow(GetDlgItem(hWnd, IDC_EDIT_Y), !seq);
     EnableWindow(GetDlgItem(hWnd, IDC_BTN_PICK), !seq);
     EnableWindow(GetDlgItem(hWnd, IDC_CHECK_HOLD), !seq);
-    EnableWindow(GetDlgItem(hWnd, IDC_RADIO_INF), !hold);
-    EnableWindow(GetDlgItem(hWnd, IDC_RADIO_CLICKS), !hold);
-    EnableWindow(GetDlgItem(hWnd, IDC_RADIO_SECONDS), !hold);
-    EnableWindow(GetDlgItem(hWnd, IDC_EDIT_CLICKS), !hold && byClicks);
-    EnableWindow(GetDlgItem(hWnd, IDC_EDIT_SECONDS), !hold && bySecs);
+    EnableWindow(GetDlgItem(hWnd, IDC_RADIO_INF), !hold && !trig);
+    EnableWindow(GetDlgItem(hWnd, IDC_RADIO_CLICKS), !hold && !trig);
+    EnableWindow(GetDlgItem(hWnd, IDC_RADIO_SECONDS), !hold && !trig);
+    EnableWindow(GetDlgItem(hWnd, IDC_EDIT_CLICKS), !hold && !trig && byClicks);
+    EnableWindow(GetDlgItem(hWnd, IDC_EDIT_SECONDS), !hold && !trig && bySecs);
+    EnableWindow(GetDlgItem(hWnd, IDC_CHECK_TRIGGER), !seq);
+    EnableWindow(GetDlgItem(hWnd, IDC_COMBO_TRIGGER), trig);
+    EnableWindow(GetDlgItem(hWnd, IDC_BTN_TRIGKEY), trig && trigKey);
     EnableWindow(GetDlgItem(hWnd, IDC_LIST_SEQ), seq);
     EnableWindow(GetDlgItem(hWnd, IDC_BTN_ADD_STEP), seq);
     EnableWindow(GetDlgItem(hWnd, IDC_BTN_REMOVE_STEP), seq);
@@ -373,9 +433,22 @@ static void UpdateUIState(HWND hWnd) {
 }
 
 // ---------------------- Picker hook -------------------------
+// Mouse trigger (TRIG_MIDDLE/X1/X2) a button message belongs to, or -1.
+static int MouseTrigSrc(WPARAM wParam, const MSLLHOOKSTRUCT* p) {
+    if (wParam == WM_MBUTTONDOWN || wParam == WM_MBUTTONUP) return TRIG_MIDDLE;
+    if (wParam == WM_XBUTTONDOWN || wParam == WM_XBUTTONUP) return HIWORD(p->mouseData) == XBUTTON1 ? TRIG_X1 : HIWORD(p->mouseData) == XBUTTON2 ? TRIG_X2 : -1;
+    return -1;
+}
+
 static LRESULT CALLBACK LowLevelMouseProc(int nCode, WPARAM wParam, LPARAM lParam) {
     if (nCode == HC_ACTION) {
         const MSLLHOOKSTRUCT* p = reinterpret_cast<const MSLLHOOKSTRUCT*>(lParam);
+        int waitUp = g_trigWaitUp.load(std::memory_order_relaxed);
+        if (waitUp && (wParam == WM_MBUTTONUP || wParam == WM_XBUTTONUP) && MouseTrigSrc(wParam, p) == waitUp) {
+            g_trigWaitUp.store(0, std::memory_order_relaxed);
+            if (!g_pickMode.load() && !g_pickSeq.load() && !g_waitUp.load() && g_mouseHook) { UnhookWindowsHookEx(g_mouseHook); g_mouseHook = nullptr; }
+            return 1; // swallow the trigger UP whose DOWN the (now gone) trigger hook swallowed
+        }
         if (g_pickMode.load(std::memory_order_relaxed) || g_pickSeq.load(std::memory_order_relaxed)) {
             if (wParam == WM_LBUTTONDOWN) {
                 PostMessageW(g_hMain, WM_APP_PICKED, (WPARAM)p->pt.x, (LPARAM)p->pt.y);
@@ -387,7 +460,7 @@ static LRESULT CALLBACK LowLevelMouseProc(int nCode, WPARAM wParam, LPARAM lPara
         else if (g_waitUp.load(std::memory_order_relaxed)) {
             if (wParam == WM_LBUTTONUP) {
                 g_waitUp.store(false, std::memory_order_relaxed);
-                if (g_mouseHook) { UnhookWindowsHookEx(g_mouseHook); g_mouseHook = nullptr; }
+                if (g_mouseHook && !g_trigWaitUp.load()) { UnhookWindowsHookEx(g_mouseHook); g_mouseHook = nullptr; }
                 return 1; // swallow UP
             }
         }
@@ -395,6 +468,66 @@ static LRESULT CALLBACK LowLevelMouseProc(int nCode, WPARAM wParam, LPARAM lPara
     return CallNextHookEx(nullptr, nCode, wParam, lParam);
 }
 
+// ---------------------- Trigger hooks -----------------------
+static LRESULT CALLBACK LowLevelTriggerMouseProc(int nCode, WPARAM wParam, LPARAM lParam) {
+    if (nCode == HC_ACTION) {
+        const MSLLHOOKSTRUCT* p = reinterpret_cast<const MSLLHOOKSTRUCT*>(lParam);
+        if (!(p->flags & LLMHF_INJECTED) && MouseTrigSrc(wParam, p) == g_trigSrc) { // never react to our own SendInput
+            // Swallow in pairs (no browser Back/Forward etc.): an UP whose DOWN reached the app (armed while held) passes through.
+            if (wParam == WM_MBUTTONDOWN || wParam == WM_XBUTTONDOWN) { g_trigHookLag.store(GetTickCount() - p->time); g_trig.Edge(true); g_trigSwallowed.store(true); return 1; }
+            if (g_trigSwallowed.exchange(false)) { g_trig.Edge(false); return 1; }
+        }
+    }
+    return CallNextHookEx(nullptr, nCode, wParam, lParam);
+}
+
+static LRESULT CALLBACK LowLevelTriggerKeyboardProc(int nCode, WPARAM wParam, LPARAM lParam) {
+    if (nCode == HC_ACTION) {
+        const KBDLLHOOKSTRUCT* p = reinterpret_cast<const KBDLLHOOKSTRUCT*>(lParam);
+        if (!(p->flags & LLKHF_INJECTED) && p->vkCode == g_trigVK) {
+            // Swallowed in pairs like the mouse trigger, so holding a letter/Space doesn't type or auto-repeat into the target.
+            if (wParam == WM_KEYDOWN || wParam == WM_SYSKEYDOWN) {
+                if (g_trigSwallowed.load()) return 1; // auto-repeat
+                if (g_trigKeyHeldAtArm) return CallNextHookEx(nullptr, nCode, wParam, lParam); // the app saw this DOWN
+                g_trigHookLag.store(GetTickCount() - p->time); g_trig.Edge(true); g_trigSwallowed.store(true); return 1;
+            }
+            if (g_trigSwallowed.exchange(false)) { g_trig.Edge(false); return 1; }
+            g_trigKeyHeldAtArm = false;
+        }
+    }
+    return CallNextHookEx(nullptr, nCode, wParam, lParam);
+}
+
+// LL hooks are called on the installing thread's message loop, so they get their own thread:
+// a busy UI thread must not delay the press edge (or hit LowLevelHooksTimeout).
+static void TriggerHookThread(HANDLE ready) {
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+    MSG msg; PeekMessageW(&msg, nullptr, 0, 0, PM_NOREMOVE); g_trigHookTid = GetCurrentThreadId(); // create the queue before anyone posts WM_QUIT
+    HHOOK h = (g_trigSrc == TRIG_KEY) ? SetWindowsHookExW(WH_KEYBOARD_LL, LowLevelTriggerKeyboardProc, GetModuleHandleW(nullptr), 0) : SetWindowsHookExW(WH_MOUSE_LL, LowLevelTriggerMouseProc, GetModuleHandleW(nullptr), 0);
+    g_trigHooked.store(h != nullptr); SetEvent(ready); if (!h) return;
+    while (GetMessageW(&msg, nullptr, 0, 0) > 0) { TranslateMessage(&msg); DispatchMessageW(&msg); }
+    UnhookWindowsHookEx(h);
+}
+static bool StartTriggerHooks() {
+    HANDLE ready = CreateEventW(nullptr, TRUE, FALSE, nullptr); g_trigHookThread = std::thread(TriggerHookThread, ready);
+    WaitForSingleObject(ready, INFINITE); CloseHandle(ready); if (g_trigHooked.load()) return true;
+    g_trigHookThread.join(); return false;
+}
+static void StopTriggerHooks() { if (!g_trigHookThread.joinable()) return; PostThreadMessageW(g_trigHookTid, WM_QUIT, 0, 0); g_trigHookThread.join(); g_trigHooked.store(false); }
+
+// Trigger key capture: the next physical key down, as a raw VK (so LShift/RCtrl/… work, and no modifiers get folded in).
+static LRESULT CALLBACK LowLevelCaptureKeyboardProc(int nCode, WPARAM wParam, LPARAM lParam) {
+    if (nCode == HC_ACTION && g_keyCapture.load(std::memory_order_relaxed)) {
+        const KBDLLHOOKSTRUCT* p = reinterpret_cast<const KBDLLHOOKSTRUCT*>(lParam);
+        if (!(p->flags & LLKHF_INJECTED) && (wParam == WM_KEYDOWN || wParam == WM_SYSKEYDOWN)) {
+            g_keyCapture.store(false, std::memory_order_relaxed); PostMessageW(g_hMain, WM_APP_TRIGKEY, (WPARAM)p->vkCode, 0);
+            if (g_kbdHook) { UnhookWindowsHookEx(g_kbdHook); g_kbdHook = nullptr; }
+            return 1; // swallow DOWN (also keeps the Start/Stop hotkey from firing)
+        }
+    }
+    return CallNextHookEx(nullptr, nCode, wParam, lParam);
+}
+
 // ---------------------- Sequence LV helpers -----------------
 static void RefreshSequenceList(HWND hWnd) {
     HWND lv = GetDlgItem(hWnd, IDC_LIST_SEQ); if (!lv) return; ListView_DeleteAllItems(lv);
@@ -481,6 +614,23 @@ static void Worker(ClickConfig cfg) {
     timeEndPeriod(1); if (autoStopped) { g_running.store(false, std::memory_order_relaxed); PostMessageW(g_hMain, WM_APP_AUTOSTOP, 0, 0); }
 }
 
+// Pre-armed: config is read and the thread exists before the press, so the press only costs a wake-up.
+static void TriggerWorker() { timeBeginPeriod(1); SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL); g_trig.Run(); timeEndPeriod(1); }
+
+static void ArmTrigger(ClickConfig cfg) {
+    g_trigSrc = (int)SendMessageW(GetDlgItem(g_hMain, IDC_COMBO_TRIGGER), CB_GETCURSEL, 0, 0); if (g_trigSrc < TRIG_KEY || g_trigSrc > TRIG_X2) g_trigSrc = TRIG_X1;
+    g_trigVK = g_trigKeyVK; if (g_trigSrc == TRIG_KEY && !g_trigVK) { SetStatus(LS(S_TRIG_NOKEY)); return; }
+    if (g_trigSrc == TRIG_KEY && g_trigVK == g_hotkeyVK && !g_hotkeyMods) { SetStatus(LS(S_TRIG_KEY_IS_HOTKEY)); return; } // holding it would just disarm
+    g_latLast = g_latMin = g_latMax = g_latSum = 0; g_latCount = 0;
+    TriggerConfig tc; tc.interval_ms = cfg.interval_ms; tc.jitter_percent = cfg.jitter_percent; tc.dbl = cfg.dbl; tc.dbl_gap_ms = (int)max(1u, min((UINT)25, GetDoubleClickTime() / 3)); tc.hold = cfg.hold;
+    g_trig.Configure(tc, [button = cfg.button, fixed = cfg.fixed, x = cfg.x, y = cfg.y](bool down) { if (down) { if (fixed) SetCursorPos(x, y); DoButtonDown(button); } else DoButtonUp(button); },
+        [](TriggerCore::Clock::duration d) { PostMessageW(g_hMain, WM_APP_TRIGLAT, (WPARAM)std::chrono::duration_cast<std::chrono::microseconds>(d).count(), (LPARAM)g_trigHookLag.load()); });
+    g_trigKeyHeldAtArm = (g_trigSrc == TRIG_KEY) && (GetAsyncKeyState((int)g_trigVK) & 0x8000);
+    g_running.store(true); g_trigArmed = true; g_worker = std::thread(TriggerWorker);
+    if (!StartTriggerHooks()) { g_running.store(false); g_trig.Stop(); g_worker.join(); g_trigArmed = false; SetStatus(LS(S_TRIG_HOOK_FAIL)); return; }
+    SetStartBtnLabel(g_hMain); SetStatus(LS(S_ARMED));
+}
+
 static void StartClicking() {
     if (g_running.load()) return; ClickConfig cfg{}; BOOL seq = (Button_GetCheck(GetDlgItem(g_hMain, IDC_CHECK_SEQUENCE)) == BST_CHECKED);
     if (seq) {
@@ -490,21 +640,30 @@ static void StartClicking() {
     }
     else {
         int raw = max(1, ReadInt(GetDlgItem(g_hMain, IDC_EDIT_INTERVAL), 100)); bool isCps = (Button_GetCheck(GetDlgItem(g_hMain, IDC_CHECK_CPS)) == BST_CHECKED); bool isHold = (Button_GetCheck(GetDlgItem(g_hMain, IDC_CHECK_HOLD)) == BST_CHECKED);
+        bool isTrigger = (Button_GetCheck(GetDlgItem(g_hMain, IDC_CHECK_TRIGGER)) == BST_CHECKED);
         if (isCps) { int cps = raw; if (cps < 1) cps = 1; if (cps > 1000) cps = 1000; cfg.interval_ms = max(1, (int)(1000 / cps)); }
         else cfg.interval_ms = raw;
         cfg.button = (int)SendMessageW(GetDlgItem(g_hMain, IDC_COMBO_BUTTON), CB_GETCURSEL, 0, 0); if (cfg.button < 0) cfg.button = 0; cfg.dbl = (Button_GetCheck(GetDlgItem(g_hMain, IDC_CHECK_DOUBLE)) == BST_CHECKED) && !isHold; cfg.fixed = (Button_GetCheck(GetDlgItem(g_hMain, IDC_CHECK_FIXED)) == BST_CHECKED);
         cfg.x = ReadInt(GetDlgItem(g_hMain, IDC_EDIT_X), 0); cfg.y = ReadInt(GetDlgItem(g_hMain, IDC_EDIT_Y), 0); cfg.hold = isHold;
         if (cfg.interval_ms < 1) cfg.interval_ms = 1; if (cfg.interval_ms > 60000) cfg.interval_ms = 60000;
-        if (!isHold) {
+        if (!isHold && !isTrigger) {
             if (Button_GetCheck(GetDlgItem(g_hMain, IDC_RADIO_CLICKS)) == BST_CHECKED) { cfg.stop_mode = 1; cfg.max_clicks = max(1, ReadInt(GetDlgItem(g_hMain, IDC_EDIT_CLICKS), 1)); }
             else if (Button_GetCheck(GetDlgItem(g_hMain, IDC_RADIO_SECONDS)) == BST_CHECKED) { cfg.stop_mode = 2; cfg.max_seconds = max(1, ReadInt(GetDlgItem(g_hMain, IDC_EDIT_SECONDS), 10)); }
             else cfg.stop_mode = 0;
         }
         cfg.jitter_percent = isHold ? 0 : ReadInt(GetDlgItem(g_hMain, IDC_EDIT_JITTER), 0); if (cfg.jitter_percent < 0) cfg.jitter_percent = 0; if (cfg.jitter_percent > 80) cfg.jitter_percent = 80;
+        if (isTrigger) { ArmTrigger(cfg); return; }
     }
     g_running.store(true); SetStartBtnLabel(g_hMain); SetStatus(seq ? LS(S_SEQ_RUNNING) : (cfg.hold ? LS(S_HOLDING) : LS(S_RUNNING))); g_worker = std::thread(Worker, cfg);
 }
-static void StopClicking() { g_running.store(false); if (g_worker.joinable()) g_worker.join(); SetStartBtnLabel(g_hMain); SetStatus(LS(S_STOPPED)); }
+static void StopClicking() {
+    g_running.store(false);
+    if (g_trigArmed) { StopTriggerHooks(); g_trig.Stop(); } // unpark the worker (and release a held button)
+    if (g_worker.joinable()) g_worker.join();
+    if (g_trigArmed && g_trigSwallowed.exchange(false) && g_trigSrc != TRIG_KEY) { g_trigWaitUp.store(g_trigSrc); if (!g_mouseHook) g_mouseHook = SetWindowsHookExW(WH_MOUSE_LL, LowLevelMouseProc, GetModuleHandleW(nullptr), 0); } // disarmed while held
+    g_trigArmed = false;
+    SetStartBtnLabel(g_hMain); SetStatus(LS(S_STOPPED));
+}
 static void ToggleClicking() { if (g_running.load()) StopClicking(); else StartClicking(); }
 
 // ---------------------- Hotkey ------------------------------
@@ -589,7 +748,13 @@ static void BuildUI(HWND hWnd) {
 
     // Start/Status
     HWND hToggle = CreateWindowW(L"BUTTON", L"", WS_CHILD | WS_VISIBLE | BS_DEFPUSHBUTTON, SX(16), SX(610), SX(150), SX(34), hWnd, (HMENU)(INT_PTR)IDC_BTN_TOGGLE, nullptr, nullptr); SendMessageW(hToggle, WM_SETFONT, (WPARAM)hFont, TRUE);
-    HWND hStatus = CreateWindowExW(WS_EX_CLIENTEDGE, L"STATIC", LS(S_READY), WS_CHILD | WS_VISIBLE | SS_LEFTNOWORDWRAP, SX(180), SX(610), SX(340), SX(34), hWnd, (HMENU)(INT_PTR)IDC_STATUS, nullptr, nullptr); SendMessageW(hStatus, WM_SETFONT, (WPARAM)hFont, TRUE);
+    HWND hStatus = CreateWindowExW(WS_EX_CLIENTEDGE, L"STATIC", LS(S_READY), WS_CHILD | WS_VISIBLE | SS_LEFTNOWORDWRAP, SX(180), SX(610), SX(396), SX(34), hWnd, (HMENU)(INT_PTR)IDC_STATUS, nullptr, nullptr); SendMessageW(hStatus, WM_SETFONT, (WPARAM)hFont, TRUE);
+
+    // Hold-to-fire trigger
+    HWND hTrig = CreateWindowW(L"BUTTON", LS(S_TRIGGER), WS_CHILD | WS_VISIBLE | BS_AUTOCHECKBOX, SX(16), SX(654), SX(190), SX(22), hWnd, (HMENU)(INT_PTR)IDC_CHECK_TRIGGER, nullptr, nullptr); SendMessageW(hTrig, WM_SETFONT, (WPARAM)hFont, TRUE);
+    HWND hTrigSrc = CreateWindowW(WC_COMBOBOXW, L"", CBS_DROPDOWNLIST | WS_CHILD | WS_VISIBLE, SX(16 + 190 + 6), SX(652), SX(160), SX(200), hWnd, (HMENU)(INT_PTR)IDC_COMBO_TRIGGER, nullptr, nullptr); SendMessageW(hTrigSrc, WM_SETFONT, (WPARAM)hFont, TRUE);
+    UpdateTriggerCombo(hWnd);
+    HWND hTrigKey = CreateWindowW(L"BUTTON", LS(S_TRIG_KEY_SET), WS_CHILD | WS_VISIBLE | BS_PUSHBUTTON, SX(16 + 190 + 6 + 160 + 8), SX(650), SX(150), SX(26), hWnd, (HMENU)(INT_PTR)IDC_BTN_TRIGKEY, nullptr, nullptr); SendMessageW(hTrigKey, WM_SETFONT, (WPARAM)hFont, TRUE);
     SetStartBtnLabel(hWnd);
 }
 
@@ -615,6 +780,7 @@ static LRESULT CALLBACK WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lPara
         case IDC_BTN_DOWN: { MoveSelectedStep(hWnd, +1); SaveSettings(hWnd); return 0; }
         case IDC_BTN_TOGGLE: { ToggleClicking(); return 0; }
         case IDC_BTN_APPLYHK: { ApplyHotkey(hWnd); SaveSettings(hWnd); return 0; }
+        case IDC_BTN_TRIGKEY: { if (!g_keyCapture.load()) { g_keyCapture.store(true); if (!g_kbdHook) g_kbdHook = SetWindowsHookExW(WH_KEYBOARD_LL, LowLevelCaptureKeyboardProc, GetModuleHandleW(nullptr), 0); SetStatus(LS(S_TRIG_KEY_PROMPT)); } return 0; }
         case IDM_TRAY_SHOWHIDE: { if (IsWindowVisible(hWnd)) HideToTray(hWnd); else RestoreFromTray(hWnd); return 0; }
         case IDM_TRAY_STARTSTOP: { ToggleClicking(); return 0; }
         case IDM_TRAY_EXIT: { TrayRemove(); DestroyWindow(hWnd); return 0; }
@@ -623,16 +789,23 @@ static LRESULT CALLBACK WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lPara
         case IDC_CHECK_SEQUENCE:
         case IDC_RADIO_INF:
         case IDC_RADIO_CLICKS:
-        case IDC_RADIO_SECONDS: { UpdateUIState(hWnd); return 0; }
+        case IDC_RADIO_SECONDS:
+        case IDC_CHECK_TRIGGER: { UpdateUIState(hWnd); return 0; }
+        case IDC_COMBO_TRIGGER: { if (HIWORD(wParam) == CBN_SELCHANGE) { UpdateUIState(hWnd); return 0; } break; }
         } break;
     }
     case WM_APP_PICKED: { int x = (int)(INT_PTR)wParam; int y = (int)(INT_PTR)lParam; if (g_pickSeq.load()) { int delay = ReadInt(GetDlgItem(hWnd, IDC_EDIT_STEP_DELAY), 100); if (delay < 0) delay = 0; if (delay > 60000) delay = 60000; g_steps.push_back(Step{ x, y, delay }); g_pickSeq.store(false); RefreshSequenceList(hWnd); SaveSettings(hWnd); SetStatus(LS(S_POINT_ADDED)); } else { SetInt(GetDlgItem(hWnd, IDC_EDIT_X), x); SetInt(GetDlgItem(hWnd, IDC_EDIT_Y), y); Button_SetCheck(GetDlgItem(hWnd, IDC_CHECK_FIXED), BST_CHECKED); SetStatus(LS(S_POINT_APPLIED)); } return 0; }
     case WM_APP_AUTOSTOP: { if (g_worker.joinable()) g_worker.join(); SetStartBtnLabel(hWnd); SetStatus(LS(S_STOPPED_COND)); return 0; }
+    case WM_APP_TRIGKEY: { UINT vk = (UINT)wParam; if (vk == g_hotkeyVK && !g_hotkeyMods) { SetStatus(LS(S_TRIG_KEY_IS_HOTKEY)); return 0; } // with a modifier (Ctrl+F6) plain F6 never fires the hotkey g_trigKeyVK = vk; SetTrigKeyLabel(hWnd); SaveSettings(hWnd); SetStatus(LS(S_TRIG_KEY_OK)); return 0; }
+    case WM_APP_TRIGLAT: {
+        if (!g_trigArmed) return 0; long long us = (long long)wParam; g_latLast = us; g_latSum += us; if (!g_latCount || us < g_latMin) g_latMin = us; if (us > g_latMax) g_latMax = us; ++g_latCount;
+        wchar_t buf[160]; _snwprintf_s(buf, _TRUNCATE, LS(S_TRIG_LATENCY), g_latLast / 1000.0, g_latMin / 1000.0, (double)g_latSum / g_latCount / 1000.0, g_latMax / 1000.0, g_latCount, (unsigned)lParam); SetStatus(buf); return 0;
+    }
     case WM_APP_TRAY: { switch (LOWORD(lParam)) { case WM_LBUTTONDBLCLK: case WM_LBUTTONUP: RestoreFromTray(hWnd); return 0; case WM_RBUTTONUP: TrayMenu(hWnd); return 0; } break; }
     case WM_SIZE: { if (wParam == SIZE_MINIMIZED) { HideToTray(hWnd); return 0; } break; }
     case WM_HOTKEY: { if ((UINT)wParam == g_hotkeyId) { ToggleClicking(); return 0; } break; }
     case WM_CLOSE: { HideToTray(hWnd); return 0; }
-    case WM_DESTROY: { SaveSettings(hWnd); UnregisterHotKey(hWnd, g_hotkeyId); TrayRemove(); PostQuitMessage(0); return 0; }
+    case WM_DESTROY: { if (g_running.load()) StopClicking(); SaveSettings(hWnd); UnregisterHotKey(hWnd, g_hotkeyId); TrayRemove(); PostQuitMessage(0); return 0; }
     }
     return DefWindowProcW(hWnd, msg, wParam, lParam);
 }
@@ -0,0 +1,80 @@
+// TriggerCore.h — portable hold-to-fire state machine (no Win32): edges in, button down/up out.
+// AutoClicker.cpp feeds it from the LL hooks; tests/ feeds it from a simulated edge source.
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+
+struct TriggerConfig {
+    int interval_ms = 100;  // between clicks while held (ignored in hold mode)
+    int jitter_percent = 0; // 0..80; randomized each tick as ±percent of interval
+    bool dbl = false;       // second click after dbl_gap_ms
+    int dbl_gap_ms = 25;
+    bool hold = false;      // hold mode: button down on press, up on release
+};
+
+class TriggerCore {
+public:
+    using Clock = std::chrono::steady_clock;
+    using EmitFn = std::function<void(bool down)>;          // inject one button down/up
+    using LatencyFn = std::function<void(Clock::duration)>; // press stamp → first down injected (per press)
+
+    // Call while Run() is not running.
+    void Configure(const TriggerConfig& cfg, EmitFn emit, LatencyFn latency) {
+        std::lock_guard<std::mutex> lk(m_); cfg_ = cfg; emit_ = std::move(emit); latency_ = std::move(latency);
+        down_ = false; stop_ = false; seq_ = served_ = 0;
+    }
+
+    // Physical edge from any source. Cheap enough for a hook callback; returns false for repeats (key auto-repeat).
+    bool Edge(bool down, Clock::time_point stamp = Clock::now()) {
+        { std::lock_guard<std::mutex> lk(m_); if (down == down_) return false; down_ = down; if (down) { ++seq_; press_at_ = stamp; } }
+        cv_.notify_one(); return true;
+    }
+
+    // Presses whose first click has been started (repeats merged before the worker woke count once).
+    uint64_t Served() { std::lock_guard<std::mutex> lk(m_); return served_; }
+
+    // Unparks Run() and makes it return; a held button (hold mode) is released first.
+    void Stop() { { std::lock_guard<std::mutex> lk(m_); stop_ = true; } cv_.notify_one(); }
+
+    // Worker body. Parks on the condition variable until a press, so the press only costs a wake-up.
+    void Run() {
+        std::mt19937 rng((unsigned)Clock::now().time_since_epoch().count());
+        std::unique_lock<std::mutex> lk(m_);
+        for (;;) {
+            cv_.wait(lk, [&] { return stop_ || seq_ != served_; }); // a tap counts even if released before we woke
+            if (stop_) break;
+            served_ = seq_; Clock::time_point stamp = press_at_;
+            lk.unlock(); emit_(true); Clock::duration lat = Clock::now() - stamp; if (latency_) latency_(lat); lk.lock();
+            if (cfg_.hold) { cv_.wait(lk, [&] { return Interrupted(); }); Emit(lk, false); continue; }
+            Emit(lk, false);
+            Clock::time_point next = Clock::now();
+            for (;;) {
+                // Every wait watches for release, stop and a new press: a re-press restarts at the first-click path above.
+                if (cfg_.dbl) { if (WaitInterrupted(lk, Clock::now() + std::chrono::milliseconds(cfg_.dbl_gap_ms))) break; Click(lk); }
+                int base = cfg_.interval_ms; int jitter = (cfg_.jitter_percent > 0) ? (base * cfg_.jitter_percent) / 100 : 0; int delta = 0; if (jitter > 0) { std::uniform_int_distribution<int> d(-jitter, +jitter); delta = d(rng); } int interval = base + delta; if (interval < 1) interval = 1;
+                next += std::chrono::milliseconds(interval); Clock::time_point now = Clock::now(); if (next < now) next = now + std::chrono::milliseconds(interval);
+                if (WaitInterrupted(lk, next)) break;
+                Click(lk);
+            }
+        }
+    }
+
+private:
+    bool Interrupted() const { return stop_ || !down_ || seq_ != served_; }
+    bool WaitInterrupted(std::unique_lock<std::mutex>& lk, Clock::time_point until) { return cv_.wait_until(lk, until, [&] { return Interrupted(); }); }
+    void Emit(std::unique_lock<std::mutex>& lk, bool down) { lk.unlock(); emit_(down); lk.lock(); }
+    void Click(std::unique_lock<std::mutex>& lk) { lk.unlock(); emit_(true); emit_(false); lk.lock(); }
+
+    std::mutex m_;
+    std::condition_variable cv_;
+    TriggerConfig cfg_;
+    EmitFn emit_;
+    LatencyFn latency_;
+    bool down_ = false, stop_ = false;
+    uint64_t seq_ = 0, served_ = 0; // presses seen / presses whose first click was sent
+    Clock::time_point press_at_;
+};
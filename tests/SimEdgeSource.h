@@ -0,0 +1,38 @@
+// SimEdgeSource.h — stand-in for the LL hooks: replays a script of physical edges into a TriggerCore
+// from its own thread, the way the hook thread does on Windows.
+#pragma once
+#include <thread>
+#include <vector>
+#include "TriggerCore.h"
+
+struct SimEdge { int after_us; bool down; }; // wait after_us since the previous edge, then press/release
+
+class SimEdgeSource {
+public:
+    explicit SimEdgeSource(TriggerCore& core) : core_(core) {}
+    ~SimEdgeSource() { Join(); }
+
+    // paced: before each press, wait until the worker has served the previous one, so a descheduled
+    // worker can't merge two scripted presses into one (timing-independent click counts).
+    void Play(std::vector<SimEdge> script, bool paced = false) {
+        Join(); stamps_.assign(script.size(), {});
+        thread_ = std::thread([this, script, paced] {
+            uint64_t presses = 0, base = core_.Served();
+            for (size_t i = 0; i < script.size(); ++i) {
+                if (paced && script[i].down) { auto until = TriggerCore::Clock::now() + std::chrono::seconds(2); while (core_.Served() - base < presses && TriggerCore::Clock::now() < until) std::this_thread::sleep_for(std::chrono::microseconds(50)); }
+                if (script[i].down) ++presses;
+                std::this_thread::sleep_for(std::chrono::microseconds(script[i].after_us));
+                TriggerCore::Clock::time_point t = TriggerCore::Clock::now(); core_.Edge(script[i].down, t);
+                stamps_[i] = TriggerCore::Clock::now(); // edge fully delivered
+            }
+        });
+    }
+    void Join() { if (thread_.joinable()) thread_.join(); }
+    // Valid after Join(): time each edge had been delivered.
+    const std::vector<TriggerCore::Clock::time_point>& Delivered() const { return stamps_; }
+
+private:
+    TriggerCore& core_;
+    std::thread thread_;
+    std::vector<TriggerCore::Clock::time_point> stamps_;
+};
@@ -0,0 +1,121 @@
+// TriggerCoreTest.cpp — hold-to-fire state machine driven by SimEdgeSource (builds with g++ on Linux: make -C tests test)
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "SimEdgeSource.h"
+
+using Clock = TriggerCore::Clock;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+static int g_failed = 0;
+#define CHECK(cond) do { if (!(cond)) { std::printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); ++g_failed; } } while (0)
+
+// Records every injected down/up and every latency sample.
+struct Recorder {
+    struct Ev { Clock::time_point at; bool down; };
+    std::mutex m; std::vector<Ev> evs; std::vector<Clock::duration> lat;
+    void Configure(TriggerCore& core, const TriggerConfig& cfg) {
+        core.Configure(cfg, [this](bool down) { std::lock_guard<std::mutex> lk(m); evs.push_back({ Clock::now(), down }); }, [this](Clock::duration d) { std::lock_guard<std::mutex> lk(m); lat.push_back(d); });
+    }
+    int Count(bool down) { std::lock_guard<std::mutex> lk(m); return (int)std::count_if(evs.begin(), evs.end(), [&](const Ev& e) { return e.down == down; }); }
+    int DownsAfter(Clock::time_point t) { std::lock_guard<std::mutex> lk(m); return (int)std::count_if(evs.begin(), evs.end(), [&](const Ev& e) { return e.down && e.at > t; }); }
+};
+
+// Runs TriggerCore::Run() on a worker thread; Finish() stops it and reports whether it returned in time.
+struct Worker {
+    TriggerCore& core; std::atomic<bool> done{ false }; std::thread t;
+    explicit Worker(TriggerCore& c) : core(c), t([this] { core.Run(); done.store(true); }) {}
+    bool Finish(milliseconds limit = milliseconds(1000)) {
+        core.Stop(); auto until = Clock::now() + limit;
+        while (!done.load() && Clock::now() < until) std::this_thread::sleep_for(milliseconds(1));
+        if (!done.load()) { std::printf("  FAIL worker did not return after Stop()\n"); std::fflush(stdout); std::_Exit(1); }
+        t.join(); return true;
+    }
+};
+
+static void WaitFor(Recorder& rec, bool down, int n) { auto until = Clock::now() + milliseconds(1000); while (rec.Count(down) < n && Clock::now() < until) std::this_thread::sleep_for(microseconds(100)); }
+static double Us(Clock::duration d) { return std::chrono::duration<double, std::micro>(d).count(); }
+
+static void TestPressToFirstEmitLatency() {
+    std::printf("press -> first emit latency\n");
+    TriggerCore core; Recorder rec; TriggerConfig cfg; cfg.interval_ms = 60000; rec.Configure(core, cfg);
+    Worker w(core); SimEdgeSource sim(core);
+    const int kPresses = 200; std::vector<SimEdge> script;
+    for (int i = 0; i < kPresses; ++i) { script.push_back({ 2000, true }); script.push_back({ 500, false }); }
+    sim.Play(script, true); sim.Join(); WaitFor(rec, false, kPresses); w.Finish();
+    CHECK((int)rec.lat.size() == kPresses); CHECK(rec.Count(true) == kPresses);
+    if (rec.lat.empty()) return;
+    std::vector<Clock::duration> v = rec.lat; std::sort(v.begin(), v.end());
+    double p50 = Us(v[v.size() / 2]), p99 = Us(v[v.size() * 99 / 100]), mx = Us(v.back());
+    // Reported, not asserted: scheduler-dependent (sub-millisecond p50 expected on an idle box).
+    std::printf("  n=%zu p50=%.1f us p99=%.1f us max=%.1f us\n", v.size(), p50, p99, mx);
+}
+
+static void TestNoEmitAfterRelease() {
+    std::printf("no emit after release\n");
+    TriggerCore core; Recorder rec; TriggerConfig cfg; cfg.interval_ms = 2; cfg.dbl = true; cfg.dbl_gap_ms = 1; rec.Configure(core, cfg);
+    Worker w(core); SimEdgeSource sim(core);
+    for (int i = 0; i < 20; ++i) {
+        sim.Play({ { 0, true }, { 3000 + i * 517, false } }); sim.Join(); Clock::time_point released = sim.Delivered()[1];
+        std::this_thread::sleep_for(milliseconds(10)); // ~5 more clicks would land here if release were ignored
+        // Click() drops the lock before emitting, so one click whose Interrupted() check preceded the release may
+        // still record its down after it; nothing beyond that in-flight click is allowed.
+        CHECK(rec.DownsAfter(released) <= 1);
+    }
+    w.Finish();
+    CHECK(rec.Count(true) == rec.Count(false)); // every click completed
+    CHECK(rec.Count(true) > 20);               // and it did click repeatedly while held
+}
+
+static void TestOneClickPerTap() {
+    std::printf("one click per short tap\n");
+    TriggerCore core; Recorder rec; TriggerConfig cfg; cfg.interval_ms = 50; rec.Configure(core, cfg);
+    Worker w(core); SimEdgeSource sim(core);
+    const int kTaps = 50; std::vector<SimEdge> script;
+    for (int i = 0; i < kTaps; ++i) { script.push_back({ 3000, true }); script.push_back({ 0, false }); } // released before the worker even wakes
+    sim.Play(script, true); sim.Join(); WaitFor(rec, false, kTaps); w.Finish();
+    CHECK(rec.Count(true) == kTaps); CHECK(rec.Count(false) == kTaps);
+}
+
+static void TestRepressDuringDoubleClickGap() {
+    std::printf("re-press inside the double-click gap\n");
+    TriggerCore core; Recorder rec; TriggerConfig cfg; cfg.interval_ms = 60000; cfg.dbl = true; cfg.dbl_gap_ms = 25; rec.Configure(core, cfg);
+    Worker w(core); SimEdgeSource sim(core);
+    sim.Play({ { 0, true }, { 5000, false }, { 2000, true } }, true); sim.Join(); WaitFor(rec, true, 2);
+    // The old schedule would hold the second press's first click for interval_ms (60 s); anything near that is the bug.
+    { std::lock_guard<std::mutex> lk(rec.m); CHECK(rec.lat.size() == 2); if (rec.lat.size() == 2) { std::printf("  second press latency %.1f us\n", Us(rec.lat[1])); CHECK(rec.lat[1] < milliseconds(1000)); } }
+    core.Edge(false); w.Finish();
+    CHECK(rec.Count(true) == rec.Count(false));
+}
+
+static void TestShutdownWhileParked() {
+    std::printf("shutdown while parked\n");
+    TriggerCore core; Recorder rec; rec.Configure(core, TriggerConfig{});
+    Worker w(core); std::this_thread::sleep_for(milliseconds(5)); w.Finish();
+    CHECK(rec.Count(true) == 0);
+}
+
+static void TestShutdownWhileHeld() {
+    std::printf("shutdown while held\n");
+    for (int hold = 0; hold <= 1; ++hold) {
+        TriggerCore core; Recorder rec; TriggerConfig cfg; cfg.interval_ms = 3; cfg.hold = hold != 0; rec.Configure(core, cfg);
+        Worker w(core); core.Edge(true); WaitFor(rec, true, 1); std::this_thread::sleep_for(milliseconds(10)); w.Finish();
+        CHECK(rec.Count(true) >= 1); CHECK(rec.Count(true) == rec.Count(false)); // hold mode: the button is released on stop
+    }
+}
+
+int main() {
+    TestPressToFirstEmitLatency();
+    TestNoEmitAfterRelease();
+    TestOneClickPerTap();
+    TestRepressDuringDoubleClickGap();
+    TestShutdownWhileParked();
+    TestShutdownWhileHeld();
+    std::printf(g_failed ? "%d check(s) failed\n" : "all passed\n", g_failed);
+    return g_failed ? 1 : 0;
+}